@@ -1,5 +1,16 @@
 #include "Common.h"
 
+//Returns the name of the filter. Used for exceptions.
+std::string getFilterName(Filter filter) {
+	switch (filter) {
+	case Filter::REMAP_FRAMES: return "RemapFrames";
+	case Filter::REMAP_FRAMES_SIMPLE: return "RemapFramesSimple";
+	case Filter::REMAP_FRAMES_INVERSE: return "RemapFramesInverse";
+	case Filter::REPLACE_FRAMES_SIMPLE: return "ReplaceFramesSimple";
+	}
+	return "";
+}
+
 //Moves col to the next non-whitespace character.
 //If there is no non-whitespace character, col will be equal to the size of the string.
 void skipWhitespace(const std::string &str, int &col) {
@@ -19,13 +30,7 @@ int getInt(const std::string &str, int &col, const int &line, const bool &file,
 	}
 
 	int frame;
-	std::string filterName; //This string stores which filter we are calling getInt from. Used for exceptions.
-
-	switch (filter) {
-	case Filter::REMAP_FRAMES: filterName = "RemapFrames"; break;
-	case Filter::REMAP_FRAMES_SIMPLE: filterName = "RemapFramesSimple"; break;
-	case Filter::REPLACE_FRAMES_SIMPLE: filterName = "ReplaceFramesSimple"; break;
-	}
+	std::string filterName{ getFilterName(filter) }; //This string stores which filter we are calling getInt from. Used for exceptions.
 
 	try {
 		frame = std::stoi(str.substr(initial, col - initial)); //Trim the string to contain the part with a single integer and then convert
@@ -71,13 +76,7 @@ void fillRange(const std::string &str, int &col, Range &range, const int &line,
 	skipWhitespace(str, col);
 	range.end = getInt(str, col, line, file, maxFrames, filter);
 
-	std::string filterName;
-
-	switch (filter) {
-	case Filter::REMAP_FRAMES: filterName = "RemapFrames"; break;
-	case Filter::REMAP_FRAMES_SIMPLE: filterName = "RemapFramesSimple"; break;
-	case Filter::REPLACE_FRAMES_SIMPLE: filterName = "ReplaceFramesSimple"; break;
-	}
+	std::string filterName{ getFilterName(filter) };
 
 	skipWhitespace(str, col);
 	if (col >= str.size() || str[col] != ']') {
@@ -88,6 +87,44 @@ void fillRange(const std::string &str, int &col, Range &range, const int &line,
 	++col;
 }
 
+//Checks for integers and keeps adding them to frameMap. Shared by RemapFramesSimple and RemapFramesInverse.
+//There are two ways we could have done this:
+//	1. Parse the entire file/string and set frameMap's size to the number of frames to avoid unnecessary resizing./..
+//	   Parse the entire file/string again - this time to actually fill frameMap.
+//	2. Resize frameMap on the go through push_back().
+//We use method 2 here.
+void parseSimple(std::string name, std::vector<unsigned int> &frameMap, void *stream, bool file, int maxFrames, Filter filter) {
+	int line{ 0 };
+	int col{ 0 };
+
+	if (!file) {
+		skipWhitespace(name, col);
+		if (col == name.size())
+			throw std::runtime_error(getFilterName(filter) + ": Video length cannot be 0");
+	}
+
+	std::string temp;
+	while (file ? std::getline(*static_cast<std::ifstream*>(stream), temp) : std::getline(*static_cast<std::stringstream*>(stream), temp)) {
+		col = 0;
+		while (col < temp.size()) {
+			skipWhitespace(temp, col);
+			char ch{ getChar(temp, col) };
+			if (ch != 0) {
+				if (ch == '#')
+					continue;
+				else if (std::isdigit(ch) || ch == '-')
+					frameMap.push_back(getInt(temp, col, line, file, maxFrames, filter));
+				else {
+					std::string location{ file ? " text file " : " mappings " };
+					std::string error{ getFilterName(filter) + ": Parse Error in" + location + "at line " + std::to_string(line + 1) + ", column " + std::to_string(col + 1) };
+					throw std::runtime_error(error);
+				}
+			}
+		}
+		line++;
+	}
+}
+
 //Below code copied and modified from "reorderfilters.c" in VS repository.
 
 MismatchCauses findCommonVi(VSVideoInfo *outVi, VSNodeRef *node2, const VSAPI *vsapi) {
@@ -118,4 +155,78 @@ MismatchCauses findCommonVi(VSVideoInfo *outVi, VSNodeRef *node2, const VSAPI *v
 		}
 	}
 	return mismatch;
+}
+
+//Fills process with the planes listed in the planes argument. If planes isn't given, all planes are processed.
+//Returns true if every plane of the format is processed, in which case frames can be passed through whole.
+//Throws a runtime error if a plane is out of range or listed twice, or if only some planes are listed
+//and the clip doesn't have a constant format.
+bool getPlanes(const VSMap *in, bool process[3], const VSFormat *format, Filter filter, const VSAPI *vsapi) {
+	int numElements{ vsapi->propNumElements(in, "planes") };
+
+	for (int i = 0; i < 3; i++)
+		process[i] = numElements <= 0;
+	if (numElements <= 0)
+		return true;
+
+	for (int i = 0; i < numElements; i++) {
+		int64_t value{ vsapi->propGetInt(in, "planes", i, 0) };
+		if (value < 0 || value > 2)
+			throw std::runtime_error(getFilterName(filter) + ": Plane index out of range");
+		int plane{ static_cast<int>(value) };
+		if (process[plane])
+			throw std::runtime_error(getFilterName(filter) + ": Plane specified twice");
+		process[plane] = true;
+	}
+
+	//Listing every plane of the format (such as the default [0, 1, 2], even on GRAY) is the same as not giving planes at all.
+	//If the format isn't constant, only a list of all three planes is accepted.
+	int numPlanes{ format ? format->numPlanes : 3 };
+	bool all{ true };
+	for (int i = 0; i < numPlanes; i++)
+		all = all && process[i];
+	if (all) {
+		for (int i = 0; i < 3; i++)
+			process[i] = true;
+		return true;
+	}
+
+	if (!format)
+		throw std::runtime_error(getFilterName(filter) + ": planes can only be used with clips of constant format");
+
+	for (int i = numPlanes; i < 3; i++) {
+		if (process[i])
+			throw std::runtime_error(getFilterName(filter) + ": Plane index out of range");
+	}
+
+	return false;
+}
+
+//Builds a frame out of the planes of base and source without copying any pixels.
+//Planes in process are taken from source, the rest from base. Frame properties are taken from base.
+//Both frames are freed. Returns nullptr and sets a filter error if the frames can't be combined.
+const VSFrameRef *mergePlanes(const VSFrameRef *base, const VSFrameRef *source, const bool process[3], Filter filter, VSFrameContext *frameCtx, VSCore *core, const VSAPI *vsapi) {
+	const VSFormat *format{ vsapi->getFrameFormat(base) };
+	int width{ vsapi->getFrameWidth(base, 0) };
+	int height{ vsapi->getFrameHeight(base, 0) };
+
+	if (format != vsapi->getFrameFormat(source) || width != vsapi->getFrameWidth(source, 0) || height != vsapi->getFrameHeight(source, 0)) {
+		std::string error{ getFilterName(filter) + ": Frame formats or dimensions don't match" };
+		vsapi->setFilterError(error.c_str(), frameCtx);
+		vsapi->freeFrame(base);
+		vsapi->freeFrame(source);
+		return nullptr;
+	}
+
+	const VSFrameRef *frames[3];
+	int planes[3];
+	for (int i = 0; i < format->numPlanes; i++) {
+		frames[i] = process[i] ? source : base;
+		planes[i] = i;
+	}
+
+	const VSFrameRef *dst{ vsapi->newVideoFrame2(format, width, height, frames, planes, base, core) };
+	vsapi->freeFrame(base);
+	vsapi->freeFrame(source);
+	return dst;
 }
\ No newline at end of file
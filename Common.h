@@ -23,13 +23,18 @@ enum class MismatchCauses {
 enum class Filter {
 	REMAP_FRAMES,
 	REMAP_FRAMES_SIMPLE,
+	REMAP_FRAMES_INVERSE,
 	REPLACE_FRAMES_SIMPLE
 };
 
+std::string getFilterName(Filter filter);
 void skipWhitespace(const std::string &str, int &col);
 int getInt(const std::string &str, int &col, const int &line, const bool &file, int maxFrames, Filter filter);
 char getChar(const std::string &str, const int &col);
 void fillRange(const std::string &str, int &col, Range &range, const int &line, const bool &file, int maxFrames, Filter filter);
+void parseSimple(std::string name, std::vector<unsigned int> &frameMap, void *stream, bool file, int maxFrames, Filter filter);
 MismatchCauses findCommonVi(VSVideoInfo *outVi, VSNodeRef *node2, const VSAPI *vsapi);
+bool getPlanes(const VSMap *in, bool process[3], const VSFormat *format, Filter filter, const VSAPI *vsapi);
+const VSFrameRef *mergePlanes(const VSFrameRef *base, const VSFrameRef *source, const bool process[3], Filter filter, VSFrameContext *frameCtx, VSCore *core, const VSAPI *vsapi);
 
 #endif
\ No newline at end of file
@@ -5,6 +5,8 @@ struct RemapData {
 	VSNodeRef *node2;
 	VSVideoInfo vi;
 	std::vector<unsigned int> frameMap;
+	bool process[3]; //Planes taken from sourceclip on remapped frames.
+	bool partial; //True if only some of the planes are remapped.
 };
 
 static void VS_CC remapInit(VSMap *in, VSMap *out, void **instanceData, VSNode *node, VSCore *core, const VSAPI *vsapi) {
@@ -16,14 +18,17 @@ static const VSFrameRef *VS_CC remapGetFrame(int n, int activationReason, void *
 	RemapData *d{ static_cast<RemapData*>(*instanceData) };
 
 	if (activationReason == arInitial) {
-		if (d->frameMap[n] == UINT_MAX)
+		//If only some planes are remapped, the frame from baseclip is needed as well.
+		if (d->frameMap[n] == UINT_MAX || d->partial)
 			vsapi->requestFrameFilter(n, d->node1, frameCtx);
-		else
+		if (d->frameMap[n] != UINT_MAX)
 			vsapi->requestFrameFilter(d->frameMap[n], d->node2, frameCtx);
 	}
 	else if (activationReason == arAllFramesReady) {
 		if (d->frameMap[n] == UINT_MAX)
 			return vsapi->getFrameFilter(n, d->node1, frameCtx);
+		if (d->partial)
+			return mergePlanes(vsapi->getFrameFilter(n, d->node1, frameCtx), vsapi->getFrameFilter(d->frameMap[n], d->node2, frameCtx), d->process, Filter::REMAP_FRAMES, frameCtx, core, vsapi);
 		return vsapi->getFrameFilter(d->frameMap[n], d->node2, frameCtx);
 	}
 
@@ -166,6 +171,18 @@ void VS_CC remapCreate(const VSMap *in, VSMap *out, void *userData, VSCore *core
 	if (err)
 		mismatch = false;
 
+	//Checked against baseclip's format before findCommonVi, which clears it on a mismatch.
+	try {
+		d.partial = !getPlanes(in, d.process, d.vi.format, Filter::REMAP_FRAMES, vsapi);
+	}
+	catch (const std::exception &ex) {
+		vsapi->setError(out, ex.what());
+		vsapi->freeNode(d.node1);
+		if (d.node1 != d.node2)
+			vsapi->freeNode(d.node2);
+		return;
+	}
+
 	//We do not accept variable clip lengths regardless of mismatch's value.
 	MismatchCauses mismatchCause = findCommonVi(&d.vi, d.node2, vsapi);
 	if (mismatchCause == MismatchCauses::DIFFERENT_LENGTHS) {
@@ -179,6 +196,15 @@ void VS_CC remapCreate(const VSMap *in, VSMap *out, void *userData, VSCore *core
 		return;
 	}
 
+	//Planes can only be combined if the clips have the same format and dimensions, regardless of mismatch's value.
+	if ((mismatchCause == MismatchCauses::DIFFERENT_DIMENSIONS || mismatchCause == MismatchCauses::DIFFERENT_FORMATS) && d.partial) {
+		vsapi->setError(out, "RemapFrames: Clip formats and dimensions must match when planes is used");
+		vsapi->freeNode(d.node1);
+		if (d.node1 != d.node2)
+			vsapi->freeNode(d.node2);
+		return;
+	}
+
 	if (static_cast<bool>(mismatchCause) && (!mismatch)) {
 		if (mismatchCause == MismatchCauses::DIFFERENT_DIMENSIONS)
 			vsapi->setError(out, "RemapFrames: Clip dimensions don't match");
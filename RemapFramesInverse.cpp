@@ -0,0 +1,207 @@
+#include "Common.h"
+
+//How frames that were dropped by RemapFramesSimple are filled in.
+enum class InversePolicy {
+	BASE,
+	PREVIOUS,
+	NEAREST
+};
+
+struct RemapInverseData {
+	VSNodeRef *node1;
+	VSNodeRef *node2;
+	VSVideoInfo vi;
+	std::vector<unsigned int> frameMap;
+};
+
+static void VS_CC remapInverseInit(VSMap *in, VSMap *out, void **instanceData, VSNode *node, VSCore *core, const VSAPI *vsapi) {
+	RemapInverseData *d{ static_cast<RemapInverseData*>(*instanceData) };
+	vsapi->setVideoInfo(&d->vi, 1, node);
+}
+
+static const VSFrameRef *VS_CC remapInverseGetFrame(int n, int activationReason, void **instanceData, void **frameData, VSFrameContext *frameCtx, VSCore *core, const VSAPI *vsapi) {
+	RemapInverseData *d{ static_cast<RemapInverseData*>(*instanceData) };
+
+	if (activationReason == arInitial) {
+		if (d->frameMap[n] == UINT_MAX)
+			vsapi->requestFrameFilter(n, d->node1, frameCtx);
+		else
+			vsapi->requestFrameFilter(d->frameMap[n], d->node2, frameCtx);
+	}
+	else if (activationReason == arAllFramesReady) {
+		if (d->frameMap[n] == UINT_MAX)
+			return vsapi->getFrameFilter(n, d->node1, frameCtx);
+		return vsapi->getFrameFilter(d->frameMap[n], d->node2, frameCtx);
+	}
+
+	return nullptr;
+}
+
+static void VS_CC remapInverseFree(void *instanceData, VSCore *core, const VSAPI *vsapi) {
+	RemapInverseData *d{ static_cast<RemapInverseData*>(instanceData) };
+	vsapi->freeNode(d->node1);
+	vsapi->freeNode(d->node2);
+	delete d;
+}
+
+//Turns a RemapFramesSimple map (processed frame -> reference frame) into a map of reference frame -> processed frame.
+//If several processed frames come from the same reference frame, the first one is used.
+//Reference frames that no processed frame came from are filled in according to policy:
+//	BASE: left as UINT_MAX, the frame is taken from the reference clip.
+//	PREVIOUS: the closest kept frame before it, or after it if there is none before.
+//	NEAREST: the closest kept frame in either direction. Ties go to the previous one.
+static void invertMap(const std::vector<unsigned int> &simpleMap, std::vector<unsigned int> &frameMap, InversePolicy policy) {
+	int numFrames = static_cast<int>(frameMap.size());
+
+	for (unsigned int i = 0; i < simpleMap.size(); i++) {
+		if (frameMap[simpleMap[i]] == UINT_MAX)
+			frameMap[simpleMap[i]] = i;
+	}
+
+	if (policy == InversePolicy::BASE)
+		return;
+
+	//Closest kept reference frame at or before each frame. -1 if there is none.
+	std::vector<int> previous(numFrames, -1);
+	int last{ -1 };
+	for (int i = 0; i < numFrames; i++) {
+		if (frameMap[i] != UINT_MAX)
+			last = i;
+		previous[i] = last;
+	}
+
+	//simpleMap is never empty, so at least one of prev and next is always found.
+	int next{ -1 };
+	for (int i = numFrames - 1; i >= 0; i--) {
+		if (frameMap[i] != UINT_MAX) {
+			next = i;
+			continue;
+		}
+		int prev{ previous[i] };
+		int pick;
+		if (policy == InversePolicy::PREVIOUS)
+			pick = (prev != -1) ? prev : next;
+		else
+			pick = (prev == -1 || (next != -1 && next - i < i - prev)) ? next : prev;
+		frameMap[i] = frameMap[pick];
+	}
+}
+
+void VS_CC remapInverseCreate(const VSMap *in, VSMap *out, void *userData, VSCore *core, const VSAPI *vsapi) {
+	RemapInverseData d;
+	d.node2 = vsapi->propGetNode(in, "processed", 0, 0);
+	d.node1 = vsapi->propGetNode(in, "reference", 0, 0);
+	d.vi = *vsapi->getVideoInfo(d.node1);
+	int numFrames{ d.vi.numFrames };
+	int processedFrames{ vsapi->getVideoInfo(d.node2)->numFrames };
+	int err;
+
+	std::string filename;
+	const char* fn{ vsapi->propGetData(in, "filename", 0, &err) };
+	if (err)
+		filename = "";
+	else
+		filename = fn;
+
+	std::string mappings;
+	const char* mp{ vsapi->propGetData(in, "mappings", 0, &err) };
+	if (err)
+		mappings = "";
+	else
+		mappings = mp;
+
+	std::string policyName;
+	const char* pl{ vsapi->propGetData(in, "policy", 0, &err) };
+	if (err)
+		policyName = "base";
+	else
+		policyName = pl;
+
+	bool mismatch{ !!vsapi->propGetInt(in, "mismatch", 0, &err) };
+	if (err)
+		mismatch = false;
+
+	InversePolicy policy;
+	if (policyName == "base")
+		policy = InversePolicy::BASE;
+	else if (policyName == "previous")
+		policy = InversePolicy::PREVIOUS;
+	else if (policyName == "nearest")
+		policy = InversePolicy::NEAREST;
+	else {
+		vsapi->setError(out, "RemapFramesInverse: policy must be \"base\", \"previous\" or \"nearest\"");
+		vsapi->freeNode(d.node1);
+		vsapi->freeNode(d.node2);
+		return;
+	}
+
+	if (mappings.empty() && filename.empty()) {
+		vsapi->setError(out, "RemapFramesInverse: Both filename and mappings cannot be empty");
+		vsapi->freeNode(d.node1);
+		vsapi->freeNode(d.node2);
+		return;
+	}
+	else if (!mappings.empty() && !filename.empty()) {
+		vsapi->setError(out, "RemapFramesInverse: mappings and filename cannot be used together");
+		vsapi->freeNode(d.node1);
+		vsapi->freeNode(d.node2);
+		return;
+	}
+
+	//The clips are expected to differ in length, so only dimensions, formats and frame rates are checked.
+	MismatchCauses mismatchCause = findCommonVi(&d.vi, d.node2, vsapi);
+	d.vi.numFrames = numFrames;
+	if (mismatchCause != MismatchCauses::DIFFERENT_LENGTHS && static_cast<bool>(mismatchCause) && (!mismatch)) {
+		if (mismatchCause == MismatchCauses::DIFFERENT_DIMENSIONS)
+			vsapi->setError(out, "RemapFramesInverse: Clip dimensions don't match");
+		else if (mismatchCause == MismatchCauses::DIFFERENT_FORMATS)
+			vsapi->setError(out, "RemapFramesInverse: Clip formats don't match");
+		else if (mismatchCause == MismatchCauses::DIFFERENT_FRAMERATES)
+			vsapi->setError(out, "RemapFramesInverse: Clip frame rates don't match");
+		vsapi->freeNode(d.node1);
+		vsapi->freeNode(d.node2);
+		return;
+	}
+
+	//The same map that was given to RemapFramesSimple. Each index is a frame of processed,
+	//and each value is the frame of reference it was taken from.
+	std::vector<unsigned int> simpleMap;
+
+	try {
+		if (!filename.empty()) {
+			std::ifstream file(filename);
+			if (!file) {
+				vsapi->setError(out, "RemapFramesInverse: Failed to open the timecodes file.");
+				vsapi->freeNode(d.node1);
+				vsapi->freeNode(d.node2);
+				return;
+			}
+			parseSimple(filename, simpleMap, &file, true, numFrames, Filter::REMAP_FRAMES_INVERSE);
+		}
+		else if (!mappings.empty()) {
+			std::stringstream stream(mappings);
+			parseSimple(mappings, simpleMap, &stream, false, numFrames, Filter::REMAP_FRAMES_INVERSE);
+		}
+	}
+	catch (const std::exception &ex) {
+		vsapi->setError(out, ex.what());
+		vsapi->freeNode(d.node1);
+		vsapi->freeNode(d.node2);
+		return;
+	}
+
+	if (simpleMap.size() != static_cast<size_t>(processedFrames)) {
+		vsapi->setError(out, "RemapFramesInverse: Number of mappings doesn't match the length of processed");
+		vsapi->freeNode(d.node1);
+		vsapi->freeNode(d.node2);
+		return;
+	}
+
+	//Each index represents a frame of the output, and each value at that index represents
+	//which frame of processed it is taken from. A value of UINT_MAX takes the frame from reference.
+	d.frameMap.assign(numFrames, UINT_MAX);
+	invertMap(simpleMap, d.frameMap, policy);
+
+	RemapInverseData *data = new RemapInverseData{ d };
+	vsapi->createFilter(in, out, "RemapInverse", remapInverseInit, remapInverseGetFrame, remapInverseFree, fmParallel, 0, data, core);
+}
\ No newline at end of file
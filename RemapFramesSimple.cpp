@@ -30,44 +30,6 @@ static void VS_CC remapSimpleFree(void *instanceData, VSCore *core, const VSAPI
 	delete d;
 }
 
-//Checks for integers and keeps adding them to frameMap.
-//There are two ways we could have done this:
-//	1. Parse the entire file/string and set frameMap's size to the number of frames to avoid unnecessary resizing./..
-//	   Parse the entire file/string again - this time to actually fill frameMap.
-//	2. Resize frameMap on the go through push_back().
-//We use method 2 here.
-static void parse(std::string name, std::vector<unsigned int> &frameMap, void *stream, bool file, int maxFrames) {
-	int line{ 0 };
-	int col{ 0 };
-
-	if (!file) {
-		skipWhitespace(name, col);
-		if (col == name.size())
-			throw std::runtime_error("RemapFramesSimple: Video length cannot be 0");
-	}
-
-	std::string temp;
-	while (file ? std::getline(*static_cast<std::ifstream*>(stream), temp) : std::getline(*static_cast<std::stringstream*>(stream), temp)) {
-		col = 0;
-		while (col < temp.size()) {
-			skipWhitespace(temp, col);
-			char ch{ getChar(temp, col) };
-			if (ch != 0) {
-				if (ch == '#')
-					continue;
-				else if (std::isdigit(ch) || ch == '-')
-					frameMap.push_back(getInt(temp, col, line, file, maxFrames, Filter::REMAP_FRAMES_SIMPLE));
-				else {
-					std::string location{ file ? " text file " : " mappings " };
-					std::string error{ "RemapFramesSimple: Parse Error in" + location + "at line " + std::to_string(line + 1) + ", column " + std::to_string(col + 1) };
-					throw std::runtime_error(error);
-				}
-			}
-		}
-		line++;
-	}
-}
-
 void VS_CC remapSimpleCreate(const VSMap *in, VSMap *out, void *userData, VSCore *core, const VSAPI *vsapi) {
 	RemapSimpleData d;
 	d.node = vsapi->propGetNode(in, "clip", 0, 0);
@@ -107,11 +69,11 @@ void VS_CC remapSimpleCreate(const VSMap *in, VSMap *out, void *userData, VSCore
 				vsapi->freeNode(d.node);
 				return;
 			}
-			parse(filename, d.frameMap, &file, true, d.vi.numFrames);
+			parseSimple(filename, d.frameMap, &file, true, d.vi.numFrames, Filter::REMAP_FRAMES_SIMPLE);
 		}
 		else if (!mappings.empty()) {
 			std::stringstream stream(mappings);
-			parse(mappings, d.frameMap, &stream, false, d.vi.numFrames);
+			parseSimple(mappings, d.frameMap, &stream, false, d.vi.numFrames, Filter::REMAP_FRAMES_SIMPLE);
 		}
 	}
 	catch (const std::exception &ex) {
@@ -5,6 +5,8 @@ struct ReplaceData {
 	VSNodeRef *node2;
 	VSVideoInfo vi;
 	std::vector<unsigned int> frameMap;
+	bool process[3]; //Planes taken from sourceclip on replaced frames.
+	bool partial; //True if only some of the planes are replaced.
 };
 
 static void VS_CC replaceInit(VSMap *in, VSMap *out, void **instanceData, VSNode *node, VSCore *core, const VSAPI *vsapi) {
@@ -17,9 +19,14 @@ static const VSFrameRef *VS_CC replaceGetFrame(int n, int activationReason, void
 
 	if (activationReason == arInitial) {
 		//Check whether frameMap returns 0 or 1 for the current frame and return the corresponding clip.
+		//If only some planes are replaced, the frame from baseclip is needed as well.
+		if (d->frameMap[n] && d->partial)
+			vsapi->requestFrameFilter(n, d->node1, frameCtx);
 		vsapi->requestFrameFilter(n, (d->frameMap[n] ? d->node2 : d->node1), frameCtx);
 	}
 	else if (activationReason == arAllFramesReady) {
+		if (d->frameMap[n] && d->partial)
+			return mergePlanes(vsapi->getFrameFilter(n, d->node1, frameCtx), vsapi->getFrameFilter(n, d->node2, frameCtx), d->process, Filter::REPLACE_FRAMES_SIMPLE, frameCtx, core, vsapi);
 		return vsapi->getFrameFilter(n, (d->frameMap[n] ? d->node2 : d->node1), frameCtx);
 	}
 
@@ -99,6 +106,17 @@ void VS_CC replaceCreate(const VSMap *in, VSMap *out, void *userData, VSCore *co
 	if (err)
 		mismatch = false;
 
+	//Checked against baseclip's format before findCommonVi, which clears it on a mismatch.
+	try {
+		d.partial = !getPlanes(in, d.process, d.vi.format, Filter::REPLACE_FRAMES_SIMPLE, vsapi);
+	}
+	catch (const std::exception &ex) {
+		vsapi->setError(out, ex.what());
+		vsapi->freeNode(d.node1);
+		vsapi->freeNode(d.node2);
+		return;
+	}
+
 	MismatchCauses mismatchCause = findCommonVi(&d.vi, d.node2, vsapi);
 	if (mismatchCause == MismatchCauses::DIFFERENT_LENGTHS) {
 		vsapi->setError(out, "ReplaceFramesSimple: Clip lengths don't match");
@@ -107,6 +125,14 @@ void VS_CC replaceCreate(const VSMap *in, VSMap *out, void *userData, VSCore *co
 		return;
 	}
 
+	//Planes can only be combined if the clips have the same format and dimensions, regardless of mismatch's value.
+	if ((mismatchCause == MismatchCauses::DIFFERENT_DIMENSIONS || mismatchCause == MismatchCauses::DIFFERENT_FORMATS) && d.partial) {
+		vsapi->setError(out, "ReplaceFramesSimple: Clip formats and dimensions must match when planes is used");
+		vsapi->freeNode(d.node1);
+		vsapi->freeNode(d.node2);
+		return;
+	}
+
 	if (static_cast<bool>(mismatchCause) && (!mismatch)) {
 		if (mismatchCause == MismatchCauses::DIFFERENT_DIMENSIONS)
 			vsapi->setError(out, "ReplaceFramesSimple: Clip dimensions don't match");